@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <memory>
 #include <fstream>
+#include <cstring>
 
 enum class DataType {
     RANDOM,
@@ -19,6 +20,11 @@ enum class DataType {
 class BenchmarkSuite {
 private:
     std::vector<std::unique_ptr<SortingAlgorithm>> algorithms;
+    std::vector<MemoryConfig> memoryConfigs;
+    
+    // Only engines whose scratch buffers go through SortAllocator and stay
+    // O(n) in memory take part in the large-input pass
+    std::vector<std::unique_ptr<SortingAlgorithm>> largeAlgorithms;
     std::ofstream csvFile;
     
     std::vector<int> generateData(int size, DataType type) {
@@ -103,9 +109,16 @@ private:
     }
     
 public:
-    BenchmarkSuite() {
+    // Memory configs are compared only on this large input, where scratch
+    // buffers are well above MemoryConfig::minBytes
+    static const int LARGE_SIZE = 64 * 1024 * 1024;
+    
+    explicit BenchmarkSuite(const std::vector<MemoryConfig>& configs = {MemoryConfig()})
+        : memoryConfigs(configs) {
         algorithms.push_back(std::make_unique<InsertionSort>());
         algorithms.push_back(std::make_unique<MergeSort>());
+        algorithms.push_back(std::make_unique<InPlaceMergeSort>());
+        algorithms.push_back(std::make_unique<InPlaceMergeSort>(0));
         algorithms.push_back(std::make_unique<QuickSort>());
         algorithms.push_back(std::make_unique<HeapSort>());
         algorithms.push_back(std::make_unique<IntroSort>());
@@ -114,8 +127,20 @@ public:
         algorithms.push_back(std::make_unique<CountingSort>());
         algorithms.push_back(std::make_unique<RadixSort>());
         
+        largeAlgorithms.push_back(std::make_unique<MergeSort>());
+        largeAlgorithms.push_back(std::make_unique<RadixSort>());
+        
         csvFile.open("benchmark_results.csv");
-        csvFile << "Algorithm,Data Type,Size,Time(ms),Comparisons,Swaps,Sorted Correctly\n";
+        csvFile << "Algorithm,Data Type,Size,Time(ms),Comparisons,Swaps,Sorted Correctly,Memory\n";
+    }
+    
+    void setPresortCheck(bool enabled) {
+        for (auto& algo : algorithms) {
+            algo->setPresortCheck(enabled);
+        }
+        for (auto& algo : largeAlgorithms) {
+            algo->setPresortCheck(enabled);
+        }
     }
     
     ~BenchmarkSuite() {
@@ -124,10 +149,27 @@ public:
         }
     }
     
+    // Default config first as the baseline, then every selected policy
+    std::vector<MemoryConfig> largeMemoryConfigs() const {
+        std::vector<MemoryConfig> configs = {MemoryConfig()};
+        for (const MemoryConfig& memory : memoryConfigs) {
+            if (!memory.isDefault()) configs.push_back(memory);
+        }
+        return configs;
+    }
+    
     void runBenchmark(int size, DataType dataType) {
+        runBenchmark(size, dataType, algorithms, {MemoryConfig()});
+    }
+    
+    void runBenchmark(int size, DataType dataType,
+                      std::vector<std::unique_ptr<SortingAlgorithm>>& algos,
+                      const std::vector<MemoryConfig>& configs) {
         std::cout << "\n" << std::string(80, '=') << "\n";
         std::cout << "Testing with " << dataTypeToString(dataType) 
                   << " data, Size: " << size << "\n";
+        std::cout << "Presortedness: "
+                  << analyzePresortedness(generateData(size, dataType)).describe() << "\n";
         std::cout << std::string(80, '=') << "\n\n";
         
         std::cout << std::left << std::setw(25) << "Algorithm"
@@ -137,33 +179,42 @@ public:
                   << std::setw(10) << "Status" << "\n";
         std::cout << std::string(80, '-') << "\n";
         
-        for (auto& algo : algorithms) {
-            std::vector<int> data = generateData(size, dataType);
-            
-            algo->resetStats();
-            
-            auto start = std::chrono::high_resolution_clock::now();
-            algo->sort(data);
-            auto end = std::chrono::high_resolution_clock::now();
-            
-            std::chrono::duration<double, std::milli> duration = end - start;
-            
-            const SortStats& stats = algo->getStats();
-            bool sorted = isSorted(data);
-            
-            std::cout << std::left << std::setw(25) << algo->getName()
-                      << std::right << std::setw(12) << std::fixed << std::setprecision(3) << duration.count()
-                      << std::setw(15) << stats.comparisons
-                      << std::setw(12) << stats.swaps
-                      << std::setw(10) << (sorted ? "✓" : "✗") << "\n";
+        for (const MemoryConfig& memory : configs) {
+            if (configs.size() > 1) {
+                std::cout << "[Memory: " << memory.describe() << "]\n";
+            }
             
-            csvFile << algo->getName() << ","
-                    << dataTypeToString(dataType) << ","
-                    << size << ","
-                    << duration.count() << ","
-                    << stats.comparisons << ","
-                    << stats.swaps << ","
-                    << (sorted ? "Yes" : "No") << "\n";
+            for (auto& algo : algos) {
+                std::vector<int> data = generateData(size, dataType);
+                
+                algo->setMemoryConfig(memory);
+                
+                algo->resetStats();
+                
+                auto start = std::chrono::high_resolution_clock::now();
+                algo->sort(data);
+                auto end = std::chrono::high_resolution_clock::now();
+                
+                std::chrono::duration<double, std::milli> duration = end - start;
+                
+                const SortStats& stats = algo->getStats();
+                bool sorted = isSorted(data);
+                
+                std::cout << std::left << std::setw(25) << algo->getName()
+                          << std::right << std::setw(12) << std::fixed << std::setprecision(3) << duration.count()
+                          << std::setw(15) << stats.comparisons
+                          << std::setw(12) << stats.swaps
+                          << std::setw(10) << (sorted ? "✓" : "✗") << "\n";
+                
+                csvFile << algo->getName() << ","
+                        << dataTypeToString(dataType) << ","
+                        << size << ","
+                        << duration.count() << ","
+                        << stats.comparisons << ","
+                        << stats.swaps << ","
+                        << (sorted ? "Yes" : "No") << ","
+                        << memory.describe() << "\n";
+            }
         }
     }
     
@@ -189,26 +240,93 @@ public:
             }
         }
         
+        // The sizes above always run with the default config: most of their
+        // buffers are below minBytes (CountingSort's count array can exceed
+        // it), so per-policy rows there would mostly repeat operator new
+        std::vector<MemoryConfig> configs = largeMemoryConfigs();
+        if (configs.size() > 1) {
+            runBenchmark(LARGE_SIZE, DataType::RANDOM, largeAlgorithms, configs);
+        }
+        
         std::cout << "\n" << std::string(80, '=') << "\n";
         std::cout << "Benchmark complete! Results saved to benchmark_results.csv\n";
         std::cout << std::string(80, '=') << "\n";
     }
 };
 
-int main() {
+// Memory configurations selectable with --memory=<mode>
+bool parseMemoryMode(const std::string& mode, std::vector<MemoryConfig>& configs) {
+    MemoryConfig config;
+    
+    if (mode == "default") {
+        configs.push_back(MemoryConfig());
+    } else if (mode == "thp") {
+        config.hugePages = HugePagePolicy::TRANSPARENT;
+        configs.push_back(config);
+    } else if (mode == "hugetlb") {
+        config.hugePages = HugePagePolicy::EXPLICIT;
+        configs.push_back(config);
+    } else if (mode == "touch") {
+        config.firstTouch = true;
+        configs.push_back(config);
+    } else if (mode == "local") {
+        config.numa = NumaPolicy::LOCAL;
+        config.firstTouch = true;
+        configs.push_back(config);
+    } else if (mode == "interleave") {
+        config.numa = NumaPolicy::INTERLEAVE;
+        configs.push_back(config);
+    } else if (mode.compare(0, 4, "node") == 0 && mode.size() > 4 && mode.size() <= 8 &&
+               mode.find_first_not_of("0123456789", 4) == std::string::npos) {
+        config.numa = NumaPolicy::BIND;
+        config.numaNode = std::stoi(mode.substr(4));
+        configs.push_back(config);
+    } else if (mode == "all") {
+        for (const char* m : {"default", "thp", "hugetlb", "touch", "local", "interleave", "node0"}) {
+            parseMemoryMode(m, configs);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<MemoryConfig> memoryConfigs;
+    bool presortCheck = true;
+    
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--memory=", 9) == 0 &&
+            parseMemoryMode(argv[i] + 9, memoryConfigs)) {
+            continue;
+        }
+        if (std::strcmp(argv[i], "--no-presort") == 0) {
+            presortCheck = false;
+            continue;
+        }
+        std::cerr << "Usage: " << argv[0]
+                  << " [--memory=default|thp|hugetlb|touch|local|interleave|node<N>|all]"
+                  << " [--no-presort]\n";
+        return 1;
+    }
+    if (memoryConfigs.empty()) {
+        memoryConfigs.push_back(MemoryConfig());
+    }
+    
     std::cout << "Sorting Algorithms Benchmark Suite\n";
     std::cout << "===================================\n\n";
     
     std::cout << "This benchmark tests the following algorithms:\n";
     std::cout << "  1. Insertion Sort - O(n²) - Used for small arrays\n";
     std::cout << "  2. Merge Sort - O(n log n) - Stable, used in Python/Java\n";
-    std::cout << "  3. Quick Sort - O(n log n) avg - Part of C++ STL\n";
-    std::cout << "  4. Heap Sort - O(n log n) - Part of C++ STL\n";
-    std::cout << "  5. Introsort - O(n log n) - Used in C++ std::sort\n";
-    std::cout << "  6. Timsort - O(n log n) - Used in Python sorted()\n";
-    std::cout << "  7. Shell Sort - O(n^1.5) - Used in embedded systems\n";
-    std::cout << "  8. Counting Sort - O(n+k) - For limited range integers\n";
-    std::cout << "  9. Radix Sort - O(d*n) - For large integer datasets\n\n";
+    std::cout << "  3. In-Place Merge Sort - O(n log^2 n) - Stable, sqrt(n) or O(1) memory\n";
+    std::cout << "  4. Quick Sort - O(n log n) avg - Part of C++ STL\n";
+    std::cout << "  5. Heap Sort - O(n log n) - Part of C++ STL\n";
+    std::cout << "  6. Introsort - O(n log n) - Used in C++ std::sort\n";
+    std::cout << "  7. Timsort - O(n log n) - Used in Python sorted()\n";
+    std::cout << "  8. Shell Sort - O(n^1.5) - Used in embedded systems\n";
+    std::cout << "  9. Counting Sort - O(n+k) - For limited range integers\n";
+    std::cout << " 10. Radix Sort - O(d*n) - For large integer datasets\n\n";
     
     std::cout << "Data patterns tested:\n";
     std::cout << "  - Random data\n";
@@ -218,10 +336,29 @@ int main() {
     std::cout << "  - Many duplicates\n";
     std::cout << "  - Few unique values\n\n";
     
+    bool wantsNuma = false;
+    bool comparesMemory = false;
+    std::cout << "Scratch memory configurations:";
+    for (const MemoryConfig& config : memoryConfigs) {
+        std::cout << " " << config.describe();
+        wantsNuma = wantsNuma || config.numa != NumaPolicy::NONE;
+        comparesMemory = comparesMemory || !config.isDefault();
+    }
+    if (wantsNuma && !numaSupported()) {
+        std::cout << " (NUMA policies unavailable, build with make NUMA=1)";
+    }
+    if (comparesMemory) {
+        std::cout << " (compared on " << BenchmarkSuite::LARGE_SIZE
+                  << " elements against default)";
+    }
+    std::cout << "\n";
+    std::cout << "Presortedness fast path: " << (presortCheck ? "on" : "off") << "\n\n";
+    
     std::cout << "Press Enter to start benchmark...\n";
     std::cin.get();
     
-    BenchmarkSuite suite;
+    BenchmarkSuite suite(memoryConfigs);
+    suite.setPresortCheck(presortCheck);
     suite.runFullBenchmark();
     
     return 0;
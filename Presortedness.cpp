@@ -0,0 +1,121 @@
+#include "Presortedness.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const size_t SAMPLE_SIZE = 1024;
+
+// Distinct-value sample grows as 4 * sqrt(n), so an all-distinct input still
+// yields about 8 values seen twice (birthday bound) for Chao1 to work with
+const size_t MIN_DISTINCT_SAMPLE = 1024;
+const size_t MAX_DISTINCT_SAMPLE = 65536;
+
+// Small deterministic generator so repeated scans give the same estimates
+struct SampleRng {
+    uint64_t state;
+
+    explicit SampleRng(uint64_t seed) : state(seed) {}
+
+    size_t next(size_t bound) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<size_t>((state >> 33) % bound);
+    }
+};
+
+// Fraction of sampled pairs i < j with a[i] > a[j], scaled to n(n-1)/2
+uint64_t estimateInversions(const std::vector<int>& arr, SampleRng& rng) {
+    size_t n = arr.size();
+    size_t inverted = 0;
+    size_t sampled = 0;
+    for (size_t s = 0; s < SAMPLE_SIZE; s++) {
+        size_t i = rng.next(n);
+        size_t j = rng.next(n);
+        if (i == j) continue;
+        if (i > j) std::swap(i, j);
+        inverted += arr[i] > arr[j];
+        sampled++;
+    }
+    if (sampled == 0) return 0;
+    double pairs = static_cast<double>(n) * (n - 1) / 2.0;
+    return static_cast<uint64_t>(pairs * inverted / sampled);
+}
+
+// Chao1 estimator: seen + f1^2 / (2 * f2), where f1 and f2 count the values
+// sampled exactly once and exactly twice; capped at n. A sample without any
+// repeat gives no information beyond "mostly distinct", so that returns n.
+size_t estimateDistinct(const std::vector<int>& arr, SampleRng& rng) {
+    size_t n = arr.size();
+    size_t scaled = static_cast<size_t>(4.0 * std::sqrt(static_cast<double>(n)));
+    size_t s = std::min(n, std::clamp(scaled, MIN_DISTINCT_SAMPLE, MAX_DISTINCT_SAMPLE));
+    std::vector<int> sample(s);
+    for (size_t k = 0; k < s; k++) {
+        sample[k] = n == s ? arr[k] : arr[rng.next(n)];
+    }
+    std::sort(sample.begin(), sample.end());
+
+    size_t seen = 0;
+    size_t once = 0;
+    size_t twice = 0;
+    for (size_t k = 0; k < s;) {
+        size_t end = k + 1;
+        while (end < s && sample[end] == sample[k]) end++;
+        seen++;
+        if (end - k == 1) once++;
+        if (end - k == 2) twice++;
+        k = end;
+    }
+
+    if (n == s) return seen;
+    if (seen == s) return n;
+    double f1 = static_cast<double>(once);
+    double estimate = twice > 0 ? seen + f1 * f1 / (2.0 * twice)
+                                : seen + f1 * (f1 - 1) / 2.0;
+    return std::min(n, static_cast<size_t>(estimate));
+}
+
+} // namespace
+
+std::string Presortedness::describe() const {
+    std::string desc = "runs=" + std::to_string(runs) +
+                       " descents=" + std::to_string(descents);
+    if (sorted) desc += " sorted";
+    if (reverseSorted) desc += " reverse-sorted";
+    if (estimatedDistinct > 0) {
+        desc += " inversions~" + std::to_string(estimatedInversions) +
+                " distinct~" + std::to_string(estimatedDistinct);
+    }
+    return desc;
+}
+
+Presortedness analyzePresortedness(const std::vector<int>& arr, bool withEstimates) {
+    Presortedness report;
+    size_t n = arr.size();
+    report.size = n;
+    if (n == 0) return report;
+
+    const int* data = arr.data();
+    size_t descents = 0;
+    size_t ascents = 0;
+    for (size_t i = 1; i < n; i++) {
+        descents += data[i] < data[i - 1];
+        ascents += data[i] > data[i - 1];
+    }
+
+    report.descents = descents;
+    report.runs = descents + 1;
+    report.sorted = descents == 0;
+    report.reverseSorted = ascents == 0 && descents > 0;
+
+    if (withEstimates) {
+        SampleRng rng(n);
+        if (report.sorted) {
+            report.estimatedInversions = 0;
+        } else {
+            report.estimatedInversions = estimateInversions(arr, rng);
+        }
+        report.estimatedDistinct = estimateDistinct(arr, rng);
+    }
+
+    return report;
+}
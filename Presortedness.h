@@ -0,0 +1,92 @@
+#ifndef PRESORTEDNESS_H
+#define PRESORTEDNESS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Measures of how much order the input already has
+struct Presortedness {
+    size_t size;
+    size_t runs;                   // maximal non-descending runs
+    size_t descents;               // adjacent pairs with a[i+1] < a[i]
+    bool sorted;                   // non-descending
+    bool reverseSorted;            // non-ascending (and not constant)
+    uint64_t estimatedInversions;  // sampled, 0 unless estimates were requested
+    size_t estimatedDistinct;      // sampled, 0 unless estimates were requested
+
+    // Average run length at which merging the existing runs beats a full sort
+    static const size_t MIN_AVERAGE_RUN = 32;
+
+    Presortedness()
+        : size(0), runs(0), descents(0), sorted(true), reverseSorted(false),
+          estimatedInversions(0), estimatedDistinct(0) {}
+
+    bool fewRuns() const { return runs > 1 && runs * MIN_AVERAGE_RUN <= size; }
+
+    std::string describe() const;
+};
+
+// One fused pass over arr counting descents and ascents; the compare loop has
+// no branches so it vectorizes. With estimates, inversions and distinct values
+// are additionally estimated from a random sample (distinct: ~4 * sqrt(n)).
+Presortedness analyzePresortedness(const std::vector<int>& arr, bool withEstimates = true);
+
+// Stack depth for mergeNaturalRuns: the collapse rule keeps pending run
+// lengths growing at least like Fibonacci numbers, so 64 covers any int size
+const int NATURAL_RUN_STACK_SIZE = 64;
+
+// Merges the maximal non-descending runs of arr. Runs are found left to right
+// as merging proceeds and kept on a TimSort-style stack, so the extra memory
+// is O(log n) whatever the number of runs. merge(left, mid, right) must merge
+// the sorted ranges [left, mid] and [mid + 1, right] in place.
+template<typename Merge>
+void mergeNaturalRuns(const std::vector<int>& arr, Merge merge) {
+    int runStart[NATURAL_RUN_STACK_SIZE];
+    int runLength[NATURAL_RUN_STACK_SIZE];
+    int pending = 0;
+
+    auto mergeAt = [&](int i) {
+        merge(runStart[i], runStart[i] + runLength[i] - 1,
+              runStart[i + 1] + runLength[i + 1] - 1);
+        runLength[i] += runLength[i + 1];
+        if (i + 2 < pending) {
+            runStart[i + 1] = runStart[i + 2];
+            runLength[i + 1] = runLength[i + 2];
+        }
+        pending--;
+    };
+
+    int n = arr.size();
+    int start = 0;
+    while (start < n) {
+        int end = start + 1;
+        while (end < n && !(arr[end] < arr[end - 1])) end++;
+
+        runStart[pending] = start;
+        runLength[pending] = end - start;
+        pending++;
+        start = end;
+
+        // Keep len[i - 2] > len[i - 1] + len[i] and len[i - 1] > len[i]
+        while (pending > 1) {
+            int i = pending - 2;
+            if ((i > 0 && runLength[i - 1] <= runLength[i] + runLength[i + 1]) ||
+                (i > 1 && runLength[i - 2] <= runLength[i - 1] + runLength[i])) {
+                if (runLength[i - 1] < runLength[i + 1]) i--;
+            } else if (runLength[i] > runLength[i + 1]) {
+                break;
+            }
+            mergeAt(i);
+        }
+    }
+
+    while (pending > 1) {
+        int i = pending - 2;
+        if (i > 0 && runLength[i - 1] < runLength[i + 1]) i--;
+        mergeAt(i);
+    }
+}
+
+#endif // PRESORTEDNESS_H
@@ -0,0 +1,143 @@
+#include "SortMemory.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef SORT_HAVE_LIBNUMA
+#include <numa.h>
+#endif
+
+namespace {
+
+const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+bool useMapping(size_t bytes, const MemoryConfig& config) {
+#ifdef __linux__
+    return !config.isDefault() && bytes >= config.minBytes;
+#else
+    (void)bytes;
+    (void)config;
+    return false;
+#endif
+}
+
+#ifdef __linux__
+size_t mappingLength(size_t bytes, const MemoryConfig& config) {
+    size_t page = config.hugePages == HugePagePolicy::NONE
+                      ? static_cast<size_t>(sysconf(_SC_PAGESIZE))
+                      : HUGE_PAGE_SIZE;
+    return (bytes + page - 1) / page * page;
+}
+
+void applyNumaPolicy(void* ptr, size_t length, const MemoryConfig& config) {
+#ifdef SORT_HAVE_LIBNUMA
+    if (!numaSupported()) return;
+    switch (config.numa) {
+        case NumaPolicy::NONE:
+            break;
+        case NumaPolicy::LOCAL:
+            numa_setlocal_memory(ptr, length);
+            break;
+        case NumaPolicy::INTERLEAVE:
+            numa_interleave_memory(ptr, length, numa_all_nodes_ptr);
+            break;
+        case NumaPolicy::BIND:
+            if (config.numaNode >= 0 && config.numaNode <= numa_max_node()) {
+                numa_tonode_memory(ptr, length, config.numaNode);
+            }
+            break;
+    }
+#else
+    (void)ptr;
+    (void)length;
+    (void)config;
+#endif
+}
+
+void* mapBuffer(size_t length, const MemoryConfig& config) {
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    void* ptr = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    if (config.hugePages == HugePagePolicy::EXPLICIT) {
+        ptr = mmap(nullptr, length, prot, flags | MAP_HUGETLB, -1, 0);
+    }
+#endif
+
+    if (ptr == MAP_FAILED) {
+        ptr = mmap(nullptr, length, prot, flags, -1, 0);
+        if (ptr == MAP_FAILED) return nullptr;
+#ifdef MADV_HUGEPAGE
+        if (config.hugePages != HugePagePolicy::NONE) {
+            madvise(ptr, length, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    // Policy must be set before the first write faults the pages in
+    applyNumaPolicy(ptr, length, config);
+
+    if (config.firstTouch) {
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        volatile char* bytes = static_cast<volatile char*>(ptr);
+        for (size_t off = 0; off < length; off += page) {
+            bytes[off] = 0;
+        }
+    }
+
+    return ptr;
+}
+#endif
+
+} // namespace
+
+std::string MemoryConfig::describe() const {
+    std::string desc;
+    switch (hugePages) {
+        case HugePagePolicy::NONE: desc = "4K"; break;
+        case HugePagePolicy::TRANSPARENT: desc = "THP"; break;
+        case HugePagePolicy::EXPLICIT: desc = "HugeTLB"; break;
+    }
+    switch (numa) {
+        case NumaPolicy::NONE: break;
+        case NumaPolicy::LOCAL: desc += "+local"; break;
+        case NumaPolicy::INTERLEAVE: desc += "+interleave"; break;
+        case NumaPolicy::BIND: desc += "+node" + std::to_string(numaNode); break;
+    }
+    if (firstTouch) desc += "+touch";
+    return desc;
+}
+
+bool numaSupported() {
+#ifdef SORT_HAVE_LIBNUMA
+    static const bool available = numa_available() >= 0;
+    return available;
+#else
+    return false;
+#endif
+}
+
+void* sortAllocate(size_t bytes, const MemoryConfig& config) {
+#ifdef __linux__
+    if (useMapping(bytes, config)) {
+        void* ptr = mapBuffer(mappingLength(bytes, config), config);
+        if (!ptr) throw std::bad_alloc();
+        return ptr;
+    }
+#endif
+    return ::operator new(bytes);
+}
+
+void sortDeallocate(void* ptr, size_t bytes, const MemoryConfig& config) {
+    if (!ptr) return;
+#ifdef __linux__
+    if (useMapping(bytes, config)) {
+        munmap(ptr, mappingLength(bytes, config));
+        return;
+    }
+#endif
+    ::operator delete(ptr);
+}
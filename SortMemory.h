@@ -0,0 +1,101 @@
+#ifndef SORT_MEMORY_H
+#define SORT_MEMORY_H
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Huge page policy for large scratch buffers
+enum class HugePagePolicy {
+    NONE,         // regular pages
+    TRANSPARENT,  // madvise(MADV_HUGEPAGE), kernel THP
+    EXPLICIT      // MAP_HUGETLB, falls back to TRANSPARENT if no pages reserved
+};
+
+// NUMA placement policy for large scratch buffers
+enum class NumaPolicy {
+    NONE,        // leave placement to first-touch
+    LOCAL,       // node of the allocating thread
+    INTERLEAVE,  // round-robin over all nodes
+    BIND         // fixed node (MemoryConfig::numaNode)
+};
+
+// Memory configuration used by the sort engines for their temporaries
+struct MemoryConfig {
+    HugePagePolicy hugePages;
+    NumaPolicy numa;
+    int numaNode;
+    bool firstTouch;     // prefault pages on the allocating thread
+    size_t minBytes;     // smaller buffers always come from operator new
+
+    MemoryConfig()
+        : hugePages(HugePagePolicy::NONE), numa(NumaPolicy::NONE),
+          numaNode(0), firstTouch(false), minBytes(1 << 20) {}
+
+    bool isDefault() const {
+        return hugePages == HugePagePolicy::NONE && numa == NumaPolicy::NONE && !firstTouch;
+    }
+
+    std::string describe() const;
+};
+
+// Raw allocation honoring a MemoryConfig. Policies that are not supported
+// on the host (no hugetlb pool, no libnuma, non-Linux) are silently dropped.
+void* sortAllocate(size_t bytes, const MemoryConfig& config);
+void sortDeallocate(void* ptr, size_t bytes, const MemoryConfig& config);
+
+// Whether NUMA policies are available in this build and on this host
+bool numaSupported();
+
+// Allocator for scratch vectors. Elements are default-initialized rather than
+// zeroed, so untouched pages stay unfaulted until the sorting thread writes them.
+template<typename T>
+class SortAllocator {
+public:
+    using value_type = T;
+
+    MemoryConfig config;
+
+    SortAllocator() = default;
+    explicit SortAllocator(const MemoryConfig& cfg) : config(cfg) {}
+
+    template<typename U>
+    SortAllocator(const SortAllocator<U>& other) : config(other.config) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(sortAllocate(n * sizeof(T), config));
+    }
+
+    void deallocate(T* p, size_t n) {
+        sortDeallocate(p, n * sizeof(T), config);
+    }
+
+    template<typename U>
+    void construct(U* p) {
+        ::new (static_cast<void*>(p)) U;
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template<typename U>
+    bool operator==(const SortAllocator<U>& other) const {
+        return config.hugePages == other.config.hugePages &&
+               config.numa == other.config.numa &&
+               config.numaNode == other.config.numaNode &&
+               config.firstTouch == other.config.firstTouch &&
+               config.minBytes == other.config.minBytes;
+    }
+
+    template<typename U>
+    bool operator!=(const SortAllocator<U>& other) const { return !(*this == other); }
+};
+
+// Scratch buffer type used by the sort engines
+using SortBuffer = std::vector<int, SortAllocator<int>>;
+
+#endif // SORT_MEMORY_H
@@ -3,8 +3,29 @@
 #include <cmath>
 #include <climits>
 
+// ============= Presortedness fast path =============
+bool SortingAlgorithm::sortIfPresorted(std::vector<int>& arr, Presortedness& report) {
+    if (!presortCheck) return false;
+    
+    report = analyzePresortedness(arr, false);
+    if (arr.size() > 1) {
+        stats.comparisons += 2 * (arr.size() - 1);
+    }
+    
+    if (report.sorted) return true;
+    
+    if (report.reverseSorted) {
+        for (size_t i = 0, j = arr.size() - 1; i < j; i++, j--) {
+            swap(arr[i], arr[j]);
+        }
+        return true;
+    }
+    return false;
+}
+
 // ============= Insertion Sort =============
 void InsertionSort::sort(std::vector<int>& arr) {
+    if (sortIfPresorted(arr)) return;
     sortRange(arr, 0, arr.size() - 1);
 }
 
@@ -25,20 +46,34 @@ void InsertionSort::sortRange(std::vector<int>& arr, int left, int right) {
 // ============= Merge Sort =============
 void MergeSort::sort(std::vector<int>& arr) {
     if (arr.size() <= 1) return;
-    std::vector<int> temp(arr.size());
+    
+    Presortedness report;
+    if (sortIfPresorted(arr, report)) return;
+    
+    SortBuffer temp(arr.size(), SortAllocator<int>(memoryConfig));
+    if (report.fewRuns()) {
+        mergeNaturalRuns(arr, [&](int left, int mid, int right) {
+            merge(arr, left, mid, right, temp);
+        });
+        return;
+    }
     mergeSort(arr, 0, arr.size() - 1, temp);
 }
 
-void MergeSort::mergeSort(std::vector<int>& arr, int left, int right, std::vector<int>& temp) {
-    if (left < right) {
-        int mid = left + (right - left) / 2;
-        mergeSort(arr, left, mid, temp);
-        mergeSort(arr, mid + 1, right, temp);
-        merge(arr, left, mid, right, temp);
+void MergeSort::mergeSort(std::vector<int>& arr, int left, int right, SortBuffer& temp) {
+    int size = right - left + 1;
+    if (size <= SORTING_NETWORK_LEAF_SIZE) {
+        sortLeaf(arr, left, size);
+        return;
     }
+    
+    int mid = left + (right - left) / 2;
+    mergeSort(arr, left, mid, temp);
+    mergeSort(arr, mid + 1, right, temp);
+    merge(arr, left, mid, right, temp);
 }
 
-void MergeSort::merge(std::vector<int>& arr, int left, int mid, int right, std::vector<int>& temp) {
+void MergeSort::merge(std::vector<int>& arr, int left, int mid, int right, SortBuffer& temp) {
     int i = left;
     int j = mid + 1;
     int k = left;
@@ -65,9 +100,187 @@ void MergeSort::merge(std::vector<int>& arr, int left, int mid, int right, std::
     }
 }
 
+// ============= In-place Merge Sort =============
+void InPlaceMergeSort::sort(std::vector<int>& arr) {
+    if (arr.size() <= 1) return;
+    
+    Presortedness report;
+    if (sortIfPresorted(arr, report)) return;
+    
+    SortBuffer owned{SortAllocator<int>(memoryConfig)};
+    if (externalBuffer) {
+        buffer = externalBuffer;
+        bufferCapacity = static_cast<int>(std::min(externalSize, arr.size()));
+    } else {
+        size_t size = bufferElements;
+        if (size == SQRT_BUFFER) {
+            size = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(arr.size()))));
+        }
+        owned.resize(std::min(size, arr.size()));
+        buffer = owned.data();
+        bufferCapacity = static_cast<int>(owned.size());
+    }
+    
+    if (report.fewRuns()) {
+        mergeNaturalRuns(arr, [&](int left, int mid, int right) {
+            merge(arr, left, mid, right);
+        });
+    } else {
+        mergeSort(arr, 0, arr.size() - 1);
+    }
+    
+    buffer = nullptr;
+    bufferCapacity = 0;
+}
+
+std::string InPlaceMergeSort::getName() const {
+    if (externalBuffer) return "In-Place Merge (buffer)";
+    if (bufferElements == SQRT_BUFFER) return "In-Place Merge (sqrt n)";
+    if (bufferElements == 0) return "In-Place Merge (O(1))";
+    return "In-Place Merge (" + std::to_string(bufferElements) + ")";
+}
+
+void InPlaceMergeSort::mergeSort(std::vector<int>& arr, int left, int right) {
+    int size = right - left + 1;
+    if (size <= SORTING_NETWORK_LEAF_SIZE) {
+        sortLeaf(arr, left, size);
+        return;
+    }
+    
+    int mid = left + (right - left) / 2;
+    mergeSort(arr, left, mid);
+    mergeSort(arr, mid + 1, right);
+    merge(arr, left, mid, right);
+}
+
+void InPlaceMergeSort::merge(std::vector<int>& arr, int left, int mid, int right) {
+    if (left > mid || mid >= right) return;
+    
+    // Runs already in order
+    if (!compare(arr[mid + 1], arr[mid])) return;
+    
+    int len1 = mid - left + 1;
+    int len2 = right - mid;
+    
+    if (len1 <= len2 && len1 <= bufferCapacity) {
+        mergeLow(arr, left, mid, right);
+        return;
+    }
+    if (len2 <= bufferCapacity) {
+        mergeHigh(arr, left, mid, right);
+        return;
+    }
+    
+    // Split the longer run in half and find the matching cut in the other
+    // run; lower/upper bound choice keeps equal keys in their original order
+    int cut1, cut2;
+    if (len1 >= len2) {
+        cut1 = left + len1 / 2;
+        cut2 = lowerBound(arr, mid + 1, right + 1, arr[cut1]);
+    } else {
+        cut2 = mid + 1 + len2 / 2;
+        cut1 = upperBound(arr, left, mid + 1, arr[cut2]);
+    }
+    
+    rotate(arr, cut1, mid + 1, cut2);
+    int newMid = cut1 + (cut2 - (mid + 1));
+    
+    merge(arr, left, cut1 - 1, newMid - 1);
+    merge(arr, newMid, cut2 - 1, right);
+}
+
+// Left run moves to the buffer, merge front to back
+void InPlaceMergeSort::mergeLow(std::vector<int>& arr, int left, int mid, int right) {
+    int len1 = mid - left + 1;
+    for (int i = 0; i < len1; i++) {
+        buffer[i] = arr[left + i];
+    }
+    
+    int i = 0, j = mid + 1, k = left;
+    
+    while (i < len1 && j <= right) {
+        if (compare(arr[j], buffer[i])) {
+            arr[k++] = arr[j++];
+        } else {
+            arr[k++] = buffer[i++];
+        }
+        stats.swaps++;
+    }
+    
+    while (i < len1) {
+        arr[k++] = buffer[i++];
+        stats.swaps++;
+    }
+}
+
+// Right run moves to the buffer, merge back to front
+void InPlaceMergeSort::mergeHigh(std::vector<int>& arr, int left, int mid, int right) {
+    int len2 = right - mid;
+    for (int j = 0; j < len2; j++) {
+        buffer[j] = arr[mid + 1 + j];
+    }
+    
+    int i = mid, j = len2 - 1, k = right;
+    
+    while (i >= left && j >= 0) {
+        if (compare(buffer[j], arr[i])) {
+            arr[k--] = arr[i--];
+        } else {
+            arr[k--] = buffer[j--];
+        }
+        stats.swaps++;
+    }
+    
+    while (j >= 0) {
+        arr[k--] = buffer[j--];
+        stats.swaps++;
+    }
+}
+
+// Exchange [left, mid) and [mid, right) with three reversals
+void InPlaceMergeSort::rotate(std::vector<int>& arr, int left, int mid, int right) {
+    if (left == mid || mid == right) return;
+    reverse(arr, left, mid - 1);
+    reverse(arr, mid, right - 1);
+    reverse(arr, left, right - 1);
+}
+
+void InPlaceMergeSort::reverse(std::vector<int>& arr, int left, int right) {
+    while (left < right) {
+        swap(arr[left++], arr[right--]);
+    }
+}
+
+// First index in [left, right) whose element is not less than value
+int InPlaceMergeSort::lowerBound(const std::vector<int>& arr, int left, int right, int value) {
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (compare(arr[mid], value)) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+// First index in [left, right) whose element is greater than value
+int InPlaceMergeSort::upperBound(const std::vector<int>& arr, int left, int right, int value) {
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (compare(value, arr[mid])) {
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+    return left;
+}
+
 // ============= Quick Sort =============
 void QuickSort::sort(std::vector<int>& arr) {
     if (arr.size() <= 1) return;
+    if (sortIfPresorted(arr)) return;
     quickSort(arr, 0, arr.size() - 1);
 }
 
@@ -95,6 +308,8 @@ int QuickSort::partition(std::vector<int>& arr, int left, int right) {
 
 // ============= Heap Sort =============
 void HeapSort::sort(std::vector<int>& arr) {
+    if (sortIfPresorted(arr)) return;
+    
     int n = arr.size();
     
     for (int i = n / 2 - 1; i >= 0; i--) {
@@ -129,6 +344,7 @@ void HeapSort::heapify(std::vector<int>& arr, int n, int i) {
 // ============= Introsort (C++ STL style) =============
 void IntroSort::sort(std::vector<int>& arr) {
     if (arr.size() <= 1) return;
+    if (sortIfPresorted(arr)) return;
     int depthLimit = getMaxDepth(arr.size());
     introSort(arr, 0, arr.size() - 1, depthLimit);
 }
@@ -136,11 +352,8 @@ void IntroSort::sort(std::vector<int>& arr) {
 void IntroSort::introSort(std::vector<int>& arr, int left, int right, int depthLimit) {
     int size = right - left + 1;
     
-    if (size <= 16) {
-        insertionSort.sortRange(arr, left, right);
-        stats.comparisons += insertionSort.getStats().comparisons;
-        stats.swaps += insertionSort.getStats().swaps;
-        insertionSort.resetStats();
+    if (size <= SORTING_NETWORK_LEAF_SIZE) {
+        sortLeaf(arr, left, size);
         return;
     }
     
@@ -198,6 +411,15 @@ int IntroSort::getMaxDepth(int n) {
 
 // ============= Timsort (Python/Java style) =============
 void TimSort::sort(std::vector<int>& arr) {
+    Presortedness report;
+    if (sortIfPresorted(arr, report)) return;
+    
+    if (report.fewRuns()) {
+        mergeNaturalRuns(arr, [&](int left, int mid, int right) {
+            merge(arr, left, mid, right);
+        });
+        return;
+    }
     timSort(arr);
 }
 
@@ -206,11 +428,8 @@ void TimSort::timSort(std::vector<int>& arr) {
     int minRun = calcMinRun(n);
     
     for (int start = 0; start < n; start += minRun) {
-        int end = std::min(start + minRun - 1, n - 1);
-        insertionSort.sortRange(arr, start, end);
-        stats.comparisons += insertionSort.getStats().comparisons;
-        stats.swaps += insertionSort.getStats().swaps;
-        insertionSort.resetStats();
+        int runSize = std::min(minRun, n - start);
+        sortLeaf(arr, start, runSize);
     }
     
     for (int size = minRun; size < n; size *= 2) {
@@ -272,6 +491,8 @@ void TimSort::merge(std::vector<int>& arr, int left, int mid, int right) {
 
 // ============= Shell Sort =============
 void ShellSort::sort(std::vector<int>& arr) {
+    if (sortIfPresorted(arr)) return;
+    
     int n = arr.size();
     
     for (int gap = n / 2; gap > 0; gap /= 2) {
@@ -291,13 +512,14 @@ void ShellSort::sort(std::vector<int>& arr) {
 // ============= Counting Sort =============
 void CountingSort::sort(std::vector<int>& arr) {
     if (arr.empty()) return;
+    if (sortIfPresorted(arr)) return;
     
     int minVal = *std::min_element(arr.begin(), arr.end());
     int maxVal = *std::max_element(arr.begin(), arr.end());
     int range = maxVal - minVal + 1;
     
-    std::vector<int> count(range, 0);
-    std::vector<int> output(arr.size());
+    SortBuffer count(range, 0, SortAllocator<int>(memoryConfig));
+    SortBuffer output(arr.size(), SortAllocator<int>(memoryConfig));
     
     for (size_t i = 0; i < arr.size(); i++) {
         count[arr[i] - minVal]++;
@@ -322,17 +544,18 @@ void CountingSort::sort(std::vector<int>& arr) {
 // ============= Radix Sort =============
 void RadixSort::sort(std::vector<int>& arr) {
     if (arr.empty()) return;
+    if (sortIfPresorted(arr)) return;
     
     int maxVal = *std::max_element(arr.begin(), arr.end());
+    SortBuffer output(arr.size(), SortAllocator<int>(memoryConfig));
     
     for (int exp = 1; maxVal / exp > 0; exp *= 10) {
-        countingSort(arr, exp);
+        countingSort(arr, exp, output);
     }
 }
 
-void RadixSort::countingSort(std::vector<int>& arr, int exp) {
+void RadixSort::countingSort(std::vector<int>& arr, int exp, SortBuffer& output) {
     int n = arr.size();
-    std::vector<int> output(n);
     std::vector<int> count(10, 0);
     
     for (int i = 0; i < n; i++) {
@@ -4,6 +4,9 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include "SortMemory.h"
+#include "SortingNetworks.h"
+#include "Presortedness.h"
 
 // Statistics structure to track algorithm performance
 struct SortStats {
@@ -25,6 +28,8 @@ struct SortStats {
 class SortingAlgorithm {
 protected:
     SortStats stats;
+    MemoryConfig memoryConfig;
+    bool presortCheck;
     
     template<typename T>
     bool compare(const T& a, const T& b) {
@@ -40,13 +45,39 @@ protected:
         b = std::move(temp);
     }
     
+    // Sorting network over arr[left, left + size). Every compare-exchange is
+    // counted as one comparison and one swap, like the other engines' moves.
+    void sortLeaf(std::vector<int>& arr, int left, int size) {
+        sortSmall(&arr[left], size);
+        stats.comparisons += sortingNetworkComparisons[size];
+        stats.swaps += sortingNetworkComparisons[size];
+    }
+    
+    // Fast path run at the start of sort(): returns true when arr is already
+    // sorted, or was non-ascending and has been reversed in place. report
+    // receives the scan so engines can pick a run-merging strategy.
+    bool sortIfPresorted(std::vector<int>& arr, Presortedness& report);
+    
+    bool sortIfPresorted(std::vector<int>& arr) {
+        Presortedness report;
+        return sortIfPresorted(arr, report);
+    }
+    
 public:
+    SortingAlgorithm() : presortCheck(true) {}
     virtual ~SortingAlgorithm() = default;
     virtual void sort(std::vector<int>& arr) = 0;
     virtual std::string getName() const = 0;
     
     const SortStats& getStats() const { return stats; }
     void resetStats() { stats.reset(); }
+    
+    // Placement of scratch buffers (huge pages, NUMA, first-touch)
+    void setMemoryConfig(const MemoryConfig& config) { memoryConfig = config; }
+    const MemoryConfig& getMemoryConfig() const { return memoryConfig; }
+    
+    // Presortedness scan before sorting (on by default)
+    void setPresortCheck(bool enabled) { presortCheck = enabled; }
 };
 
 // Insertion Sort - used for small arrays in hybrid algorithms
@@ -60,14 +91,55 @@ public:
 // Merge Sort - stable, O(n log n), used in Python/Java (Timsort)
 class MergeSort : public SortingAlgorithm {
 private:
-    void mergeSort(std::vector<int>& arr, int left, int right, std::vector<int>& temp);
-    void merge(std::vector<int>& arr, int left, int mid, int right, std::vector<int>& temp);
+    void mergeSort(std::vector<int>& arr, int left, int right, SortBuffer& temp);
+    void merge(std::vector<int>& arr, int left, int mid, int right, SortBuffer& temp);
     
 public:
     void sort(std::vector<int>& arr) override;
     std::string getName() const override { return "Merge Sort"; }
 };
 
+// In-place Merge Sort - stable, bounded extra memory. Merges whose shorter run
+// fits in the buffer are linear; larger ones are split by binary search and
+// rotation until they fit, so memory stays O(buffer) at O(n log^2 n) worst case.
+class InPlaceMergeSort : public SortingAlgorithm {
+public:
+    // Buffer size meaning ceil(sqrt(n)) elements, allocated per sort() call
+    static const size_t SQRT_BUFFER = static_cast<size_t>(-1);
+    
+private:
+    size_t bufferElements;
+    int* externalBuffer;
+    size_t externalSize;
+    
+    int* buffer;
+    int bufferCapacity;
+    
+    void mergeSort(std::vector<int>& arr, int left, int right);
+    void merge(std::vector<int>& arr, int left, int mid, int right);
+    void mergeLow(std::vector<int>& arr, int left, int mid, int right);
+    void mergeHigh(std::vector<int>& arr, int left, int mid, int right);
+    void rotate(std::vector<int>& arr, int left, int mid, int right);
+    void reverse(std::vector<int>& arr, int left, int right);
+    int lowerBound(const std::vector<int>& arr, int left, int right, int value);
+    int upperBound(const std::vector<int>& arr, int left, int right, int value);
+    
+public:
+    // bufferElements = 0 gives O(1) extra memory
+    explicit InPlaceMergeSort(size_t bufferElements = SQRT_BUFFER)
+        : bufferElements(bufferElements), externalBuffer(nullptr), externalSize(0),
+          buffer(nullptr), bufferCapacity(0) {}
+    
+    // Caller-owned scratch space, used instead of allocating; nullptr clears it
+    void setBuffer(int* data, size_t size) {
+        externalBuffer = data;
+        externalSize = data ? size : 0;
+    }
+    
+    void sort(std::vector<int>& arr) override;
+    std::string getName() const override;
+};
+
 // Quick Sort - average O(n log n), used in C++ STL (as part of Introsort)
 class QuickSort : public SortingAlgorithm {
 private:
@@ -92,7 +164,6 @@ public:
 // Introsort - hybrid algorithm used in C++ STL std::sort
 class IntroSort : public SortingAlgorithm {
 private:
-    InsertionSort insertionSort;
     HeapSort heapSort;
     
     void introSort(std::vector<int>& arr, int left, int right, int depthLimit);
@@ -100,6 +171,10 @@ private:
     int getMaxDepth(int n);
     
 public:
+    // Depth-limit fallback ranges come from a partition, a presort scan there
+    // would only repeat work
+    IntroSort() { heapSort.setPresortCheck(false); }
+    
     void sort(std::vector<int>& arr) override;
     std::string getName() const override { return "Intro Sort (STL-style)"; }
 };
@@ -109,8 +184,6 @@ class TimSort : public SortingAlgorithm {
 private:
     static const int MIN_MERGE = 32;
     
-    InsertionSort insertionSort;
-    
     void timSort(std::vector<int>& arr);
     int calcMinRun(int n);
     void merge(std::vector<int>& arr, int left, int mid, int right);
@@ -137,7 +210,7 @@ public:
 // Radix Sort - O(d*n) for integers, used for large datasets
 class RadixSort : public SortingAlgorithm {
 private:
-    void countingSort(std::vector<int>& arr, int exp);
+    void countingSort(std::vector<int>& arr, int exp, SortBuffer& output);
     
 public:
     void sort(std::vector<int>& arr) override;
@@ -0,0 +1,105 @@
+#ifndef SORTING_NETWORKS_H
+#define SORTING_NETWORKS_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+// Largest size covered by the small-sort kernels
+constexpr int SORTING_NETWORK_MAX_SIZE = 32;
+
+// Range size at which divide-and-conquer engines switch to a network leaf
+constexpr int SORTING_NETWORK_LEAF_SIZE = 16;
+
+// One compare-exchange: afterwards data[first] <= data[second]
+struct NetworkComparator {
+    int first;
+    int second;
+};
+
+// Batcher's odd-even merge network for n inputs. Comparators touching an
+// index >= n are dropped (treated as +infinity), which keeps the network
+// valid for sizes that are not a power of two. Writes to out when non-null
+// and returns the number of comparators.
+constexpr int buildSortingNetwork(int n, NetworkComparator* out) {
+    int count = 0;
+    for (int p = 1; p < n; p *= 2) {
+        for (int k = p; k >= 1; k /= 2) {
+            for (int j = k % p; j + k < n; j += 2 * k) {
+                for (int i = 0; i < k && i + j + k < n; i++) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        if (out) {
+                            out[count] = NetworkComparator{i + j, i + j + k};
+                        }
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+    return count;
+}
+
+template<int N>
+struct SortingNetwork {
+    static constexpr int size = buildSortingNetwork(N, nullptr);
+
+    static constexpr std::array<NetworkComparator, size> build() {
+        std::array<NetworkComparator, size> comparators{};
+        buildSortingNetwork(N, comparators.data());
+        return comparators;
+    }
+
+    static constexpr std::array<NetworkComparator, size> comparators = build();
+};
+
+// Branchless compare-exchange, compiles to min/max (cmov) on int
+inline void compareExchange(int* data, int i, int j) {
+    int a = data[i];
+    int b = data[j];
+    data[i] = a < b ? a : b;
+    data[j] = a < b ? b : a;
+}
+
+template<int N, std::size_t... I>
+inline void applySortingNetwork(int* data, std::index_sequence<I...>) {
+    (compareExchange(data,
+                     SortingNetwork<N>::comparators[I].first,
+                     SortingNetwork<N>::comparators[I].second), ...);
+}
+
+// Sort exactly N elements starting at data with a fully unrolled network
+template<int N>
+inline void sortSmall(int* data) {
+    static_assert(N >= 0 && N <= SORTING_NETWORK_MAX_SIZE, "sortSmall supports 0..32 elements");
+    if constexpr (N >= 2) {
+        applySortingNetwork<N>(data, std::make_index_sequence<SortingNetwork<N>::size>());
+    }
+}
+
+using SmallSortKernel = void (*)(int*);
+
+template<std::size_t... N>
+constexpr std::array<SmallSortKernel, sizeof...(N)> makeSmallSortTable(std::index_sequence<N...>) {
+    return {{&sortSmall<static_cast<int>(N)>...}};
+}
+
+template<std::size_t... N>
+constexpr std::array<int, sizeof...(N)> makeComparatorCountTable(std::index_sequence<N...>) {
+    return {{SortingNetwork<static_cast<int>(N)>::size...}};
+}
+
+// Kernels indexed by element count
+inline constexpr std::array<SmallSortKernel, SORTING_NETWORK_MAX_SIZE + 1> smallSortTable =
+    makeSmallSortTable(std::make_index_sequence<SORTING_NETWORK_MAX_SIZE + 1>());
+
+// Compare-exchanges performed by the kernel for each element count
+inline constexpr std::array<int, SORTING_NETWORK_MAX_SIZE + 1> sortingNetworkComparisons =
+    makeComparatorCountTable(std::make_index_sequence<SORTING_NETWORK_MAX_SIZE + 1>());
+
+// Sort n (<= SORTING_NETWORK_MAX_SIZE) elements starting at data
+inline void sortSmall(int* data, int n) {
+    smallSortTable[n](data);
+}
+
+#endif // SORTING_NETWORKS_H